@@ -10,6 +10,8 @@
 
 #include "gtest/gtest.h"
 #include "Types.hpp"
+#include "lib.AbstractThreadTask.hpp"
+#include "lib.Stream.hpp"
 
 /**
  * @brief Number of cycles when a test would wait a result.
@@ -18,6 +20,20 @@
     #define EOOS_TESTS_WAIT_CYCLE_TIME (0x0FFFFFFF)
 #endif
 
+/**
+ * @brief Time in milliseconds when a benchmark test would measure a result.
+ */
+#ifndef EOOS_TESTS_BENCHMARK_TIME
+    #define EOOS_TESTS_BENCHMARK_TIME (100)
+#endif
+
+/**
+ * @brief Size in Bytes of memory of the monotonic allocator, which is a multiple of 8.
+ */
+#ifndef EOOS_TESTS_MONOTONIC_ALLOCATOR_SIZE
+    #define EOOS_TESTS_MONOTONIC_ALLOCATOR_SIZE (4096U)
+#endif
+
 namespace eoos
 {
 
@@ -26,6 +42,16 @@ namespace eoos
  */
 static const uint32_t TESTS_WAIT_CYCLE_TIME( EOOS_TESTS_WAIT_CYCLE_TIME );
 
+/**
+ * @brief Time in milliseconds when a benchmark test would measure a result.
+ */
+static const int32_t TESTS_BENCHMARK_TIME( EOOS_TESTS_BENCHMARK_TIME );
+
+/**
+ * @brief Size in Bytes of memory of the monotonic allocator.
+ */
+static const size_t TESTS_MONOTONIC_ALLOCATOR_SIZE( EOOS_TESTS_MONOTONIC_ALLOCATOR_SIZE );
+
 /**
  * @class NullAllocator
  * @brief No memory allocator.
@@ -54,6 +80,240 @@ public:
 
 };
 
+/**
+ * @class MonotonicAllocator
+ * @brief Bump-pointer memory allocator which frees all the memory at once.
+ *
+ * @note The allocator is not thread safe.
+ */
+class MonotonicAllocator
+{
+
+public:
+
+    /**
+     * @brief Alignment of memory blocks in Bytes.
+     */
+    static const size_t ALIGNMENT = sizeof(uint64_t);
+
+    /**
+     * @brief Allocates memory.
+     *
+     * @param size Number of bytes to allocate.
+     * @return Allocated memory address or a null pointer.
+     */
+    static void* allocate(size_t size)
+    {
+        size_t& offset( getOffset() );
+        if( (size == 0U) || (size > TESTS_MONOTONIC_ALLOCATOR_SIZE - offset) )
+        {
+            return NULLPTR;
+        }
+        // The offset and the memory size are aligned, so the aligned size cannot exceed the rest
+        size_t const aligned( (size + ALIGNMENT - 1U) & ~(ALIGNMENT - 1U) );
+        void* const addr( reinterpret_cast<uint8_t*>( getMemory() ) + offset );
+        offset += aligned;
+        return addr;
+    }
+
+    /**
+     * @brief Does nothing as memory is freed by reset.
+     */
+    static void free(void*)
+    {
+    }
+
+    /**
+     * @brief Frees all allocated memory.
+     */
+    static void reset()
+    {
+        getOffset() = 0U;
+    }
+
+    /**
+     * @brief Returns the allocator memory address.
+     *
+     * @return The first memory block address.
+     */
+    static void* getMemory()
+    {
+        static uint64_t memory[TESTS_MONOTONIC_ALLOCATOR_SIZE / sizeof(uint64_t)];
+        return memory;
+    }
+
+private:
+
+    /**
+     * @brief Returns offset of next memory block.
+     *
+     * @return The offset in Bytes.
+     */
+    static size_t& getOffset()
+    {
+        static size_t offset( 0U );
+        return offset;
+    }
+
+};
+
+/**
+ * @class BenchmarkTask
+ * @brief Thread counting benchmark operations until it is stopped.
+ */
+class BenchmarkTask : public lib::AbstractThreadTask<>
+{
+    typedef lib::AbstractThreadTask<> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    BenchmarkTask() : Parent(),
+        count_ (0U),
+        toCount_ (true),
+        isFailed_ (false){
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~BenchmarkTask()
+    {
+    }
+
+    /**
+     * @brief Stops counter.
+     */
+    void stopCounter()
+    {
+        toCount_ = false;
+    }
+
+    /**
+     * @brief Returns number of operations done.
+     *
+     * @return Counter value.
+     */
+    uint64_t getCounter() const
+    {
+        return count_;
+    }
+
+    /**
+     * @brief Tests if an operation failed.
+     *
+     * @return True if an operation failed and the counting was stopped.
+     */
+    bool_t isFailed() const
+    {
+        return isFailed_;
+    }
+
+protected:
+
+    /**
+     * @brief Tests if the counter is not stopped.
+     *
+     * @return True if the benchmark has to count.
+     */
+    bool_t isCounting() const
+    {
+        return toCount_;
+    }
+
+    /**
+     * @brief Does one iteration of the benchmark.
+     *
+     * @return Number of operations done, or -1 if an operation failed.
+     */
+    virtual int32_t iterate() = 0;
+
+private:
+
+    /**
+     * @copydoc eoos::api::Task::start()
+     */
+    virtual void start()
+    {
+        uint64_t count( 0U );
+        while( toCount_ )
+        {
+            int32_t const number( iterate() );
+            if(number < 0)
+            {
+                isFailed_ = true;
+                break;
+            }
+            count += static_cast<uint64_t>(number);
+            count_ = count;
+        }
+    }
+
+    uint64_t volatile count_;   ///< Counter.
+    bool_t volatile toCount_;   ///< Has to count flag.
+    bool_t volatile isFailed_;  ///< Operation failed flag.
+};
+
+/**
+ * @brief Returns a benchmark rate in thousands of operations per second.
+ *
+ * @param counter Number of operations done during the benchmark time.
+ * @return The rate clamped to the maximum 32-bit integer.
+ */
+inline int32_t getBenchmarkRate(uint64_t counter)
+{
+    const uint64_t MAX_RATE( 0x7FFFFFFFU );
+    // Operations per millisecond are thousands of operations per second
+    uint64_t rate( counter / static_cast<uint64_t>(TESTS_BENCHMARK_TIME) );
+    if(rate > MAX_RATE)
+    {
+        rate = MAX_RATE;
+    }
+    return static_cast<int32_t>(rate);
+}
+
+/**
+ * @brief Outputs a benchmark rate in thousands of operations per second.
+ *
+ * @param label Label of the benchmark.
+ * @param counter Number of operations done during the benchmark time.
+ */
+inline void reportRate(char_t const* label, uint64_t counter)
+{
+    lib::Stream::cout() << "[    BENCH ] " << label << ": " << getBenchmarkRate(counter) << " thousand per second" << "\n";
+}
+
+/**
+ * @brief Outputs a benchmark rate in thousands of operations per second.
+ *
+ * @param label Label of the benchmark.
+ * @param value Value of the benchmark parameter to output after the label.
+ * @param counter Number of operations done during the benchmark time.
+ */
+inline void reportRate(char_t const* label, int32_t value, uint64_t counter)
+{
+    lib::Stream::cout() << "[    BENCH ] " << label << " " << value << ": " << getBenchmarkRate(counter) << " thousand per second" << "\n";
+}
+
+/**
+ * @brief Outputs a benchmark result in percent of a reference value.
+ *
+ * @param label Label of the benchmark.
+ * @param value Value measured by the benchmark.
+ * @param reference Reference value the measured value is compared with.
+ */
+inline void reportShare(char_t const* label, uint64_t value, uint64_t reference)
+{
+    uint64_t share( 0U );
+    if(reference != 0U)
+    {
+        share = value * 100U / reference;
+    }
+    lib::Stream::cout() << "[    BENCH ] " << label << ": " << static_cast<int32_t>(share) << " percent" << "\n";
+}
+
 } // namespace eoos
 
 #endif // TESTS_HPP_
@@ -675,6 +675,48 @@ TEST_F(lib_BaseStringDynamicTest_char_t, concatenate)
     }    
 }
 
+/**
+ * @relates lib_BaseStringDynamicTest_char_t
+ * @brief Tests the class string growth by concatenation.
+ *
+ * @b Arrange:
+ *      - Initialize the EOOS system.
+ *
+ * @b Act:
+ *      - Consctuct an empty object of the class.
+ *      - Concatenate the alphabet characters one by one many times.
+ *
+ * @b Assert:
+ *      - Test the object is correct after each concatenation.
+ */
+TEST_F(lib_BaseStringDynamicTest_char_t, concatenate_growth)
+{
+    const int32_t ALPHABET_LENGTH( 26 );
+    const int32_t TIMES( 16 );
+    String dst;
+    for(int32_t i=0; i<TIMES; i++)
+    {
+        for(int32_t j=0; j<ALPHABET_LENGTH; j++)
+        {
+            char_t const chr[2] = { ALPHABET[j], '\0' };
+            String const src( chr );
+            bool_t const res( dst.concatenate(src) );
+            ASSERT_TRUE(res) << "Fatal: Concatenation is not done";
+            int32_t const length( i * ALPHABET_LENGTH + j + 1 );
+            ASSERT_EQ(dst.getLength(), length) << "Fatal: String has wrong length";
+            ASSERT_EQ(dst.getChar()[length - 1], ALPHABET[j]) << "Fatal: String has wrong last character";
+        }
+    }
+    for(int32_t i=0; i<TIMES; i++)
+    {
+        for(int32_t j=0; j<ALPHABET_LENGTH; j++)
+        {
+            EXPECT_EQ(dst.getChar()[i * ALPHABET_LENGTH + j], ALPHABET[j]) << "Fatal: String has wrong characters";
+        }
+    }
+    EXPECT_EQ(dst.getChar()[TIMES * ALPHABET_LENGTH], '\0') << "Fatal: String is not terminated";
+}
+
 /**
  * @relates lib_BaseStringDynamicTest_char_t
  * @brief Tests the class string concatenation.
@@ -8,6 +8,7 @@
 #include "lib.Guard.hpp"
 #include "lib.Mutex.hpp"
 #include "lib.AbstractThreadTask.hpp"
+#include "lib.Thread.hpp"
 #include "System.hpp"
 
 namespace eoos
@@ -250,6 +251,51 @@ protected:
     
     };
 
+    /**
+     * @class ThreadAcquire
+     * @brief Thread incrementing a resource under a mutex.
+     */
+    class ThreadAcquire : public BenchmarkTask
+    {
+    
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param mutex Mutex resource to lock on.
+         * @param resource Atomic resource.
+         */
+        ThreadAcquire(api::Mutex& mutex, int64_t& resource)
+            : BenchmarkTask()
+            , mutex_( mutex )
+            , resource_( resource ) {
+        }
+            
+    private:
+    
+        /**
+         * @copydoc eoos::BenchmarkTask::iterate()
+         */
+        virtual int32_t iterate()
+        {
+            lib::Guard<> const guard(mutex_);
+            resource_++;
+            return 1;
+        }
+
+        /**
+         * @brief Mutex resource to lock on.
+         */
+        api::Mutex& mutex_;
+
+        /**
+         * @brief Atomic resource.
+         */
+        int64_t& resource_;
+    
+    };
+
 private:
     
     System eoos_; ///< EOOS Operating System.    
@@ -365,5 +411,55 @@ TEST_F(lib_GuardTest, atomic)
     EXPECT_TRUE(countDw.join()) << "Error: Thread was not joined";
 }
 
+/**
+ * @relates lib_GuardTest
+ * @brief Benchmarks mutex acquisition by concurrent threads. 
+ *
+ * @b Arrange:
+ *      - Initialize the EOOS system.
+ *
+ * @b Act:
+ *      - Create 1, 2 and 4 threads and pass them a mutex.
+ *      - Run the threads to increment a global variable under the mutex during the benchmark time.
+ *
+ * @b Assert:
+ *      - Check the variable equals the total number of acquisitions.
+ *      - Output the number of acquisitions per second for each number of threads.
+ */
+TEST_F(lib_GuardTest, benchmark_contention)
+{
+    const int32_t MAX_THREADS( 4 );
+    Mutex<> mutex;
+    for(int32_t number=1; number<=MAX_THREADS; number*=2)
+    {
+        int64_t resource( 0 );
+        ThreadAcquire* threads[MAX_THREADS] = { NULLPTR };
+        for(int32_t i=0; i<number; i++)
+        {
+            threads[i] = new ThreadAcquire(mutex, resource);
+            ASSERT_NE(threads[i], NULLPTR) << "Fatal: Thread is not allocated";
+        }
+        for(int32_t i=0; i<number; i++)
+        {
+            EXPECT_TRUE(threads[i]->execute()) << "Error: Thread was not executed";
+        }
+        EXPECT_TRUE(Thread<>::sleep(TESTS_BENCHMARK_TIME)) << "Error: Thread sleep got a system error";
+        for(int32_t i=0; i<number; i++)
+        {
+            threads[i]->stopCounter();
+        }
+        uint64_t counter( 0U );
+        for(int32_t i=0; i<number; i++)
+        {
+            EXPECT_TRUE(threads[i]->join()) << "Error: Thread was not joined";
+            counter += threads[i]->getCounter();
+            delete threads[i];
+        }
+        EXPECT_NE(counter, 0U) << "Fatal: Mutex acquisition is not counted";
+        EXPECT_EQ(static_cast<uint64_t>(resource), counter) << "Fatal: Mutex was not locked on atomic resource access";
+        reportRate("Mutex acquisitions by threads", number, counter);
+    }
+}
+
 } // namespace lib
 } // namespace eoos
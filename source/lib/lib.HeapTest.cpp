@@ -8,6 +8,7 @@
 #include "lib.Heap.hpp"
 #include "lib.Mutex.hpp"
 #include "lib.Memory.hpp"
+#include "lib.Thread.hpp"
 #include "System.hpp"
 
 namespace eoos
@@ -30,6 +31,40 @@ static uint64_t memory_[MEMORY_SIZE / sizeof(uint64_t)];
  */
 static uintptr_t address_( reinterpret_cast<uintptr_t>(memory_) );
 
+/**
+ * @brief Churn heap size in Bytes.
+ */
+#ifndef EOOS_TESTS_HEAP_CHURN_SIZE
+    #define EOOS_TESTS_HEAP_CHURN_SIZE (0x400000U)
+#endif
+
+/**
+ * @brief Churn heap size in Bytes.
+ */    
+const size_t CHURN_MEMORY_SIZE( EOOS_TESTS_HEAP_CHURN_SIZE );
+
+/**
+ * @brief Number of allocate and free pairs of the churn benchmark.
+ */
+#ifndef EOOS_TESTS_HEAP_CHURN_PAIRS
+    #define EOOS_TESTS_HEAP_CHURN_PAIRS (1000000)
+#endif
+
+/**
+ * @brief Number of allocate and free pairs of the churn benchmark.
+ */
+const int32_t CHURN_PAIRS( EOOS_TESTS_HEAP_CHURN_PAIRS );
+
+/**
+ * @brief Churn heap memory.
+ */
+static uint64_t churnMemory_[CHURN_MEMORY_SIZE / sizeof(uint64_t)];
+
+/**
+ * @brief Churn heap memory address.
+ */
+static uintptr_t churnAddress_( reinterpret_cast<uintptr_t>(churnMemory_) );
+
 namespace
 {
 
@@ -85,6 +120,214 @@ protected:
     virtual void TearDown() 
     {
     }    
+
+    /**
+     * @brief Returns size of the largest memory block a heap can allocate.
+     *
+     * @param heap Heap to probe.
+     * @param size Heap size in Bytes.
+     * @return Size in Bytes.
+     */
+    static size_t getLargestBlockSize(api::Heap& heap, size_t size = MEMORY_SIZE)
+    {
+        size_t min( 0U );
+        size_t max( size );
+        while(min < max)
+        {
+            size_t const probe( (min + max + 1U) / 2U );
+            void* const addr( heap.allocate(probe, NULLPTR) );
+            if(addr != NULLPTR)
+            {
+                heap.free(addr);
+                min = probe;
+            }
+            else
+            {
+                max = probe - 1U;
+            }
+        }
+        return min;
+    }
+
+    /**
+     * @class ThreadAllocate
+     * @brief Thread allocating and freeing memory blocks of a heap.
+     */
+    class ThreadAllocate : public BenchmarkTask
+    {
+        typedef BenchmarkTask Parent;
+    
+    public:
+    
+        /**
+         * @brief Constructor.
+         *
+         * @param heap Heap to allocate memory blocks.
+         * @param size Size of a memory block in Bytes.
+         */
+        ThreadAllocate(api::Heap& heap, size_t size) : Parent(),
+            heap_ (heap),
+            size_ (size),
+            toFill_ (false),
+            pattern_ (0U){
+        }
+
+        /**
+         * @brief Constructor.
+         *
+         * @param heap Heap to allocate memory blocks.
+         * @param size Size of a memory block in Bytes.
+         * @param pattern Pattern to fill and verify a memory block.
+         */
+        ThreadAllocate(api::Heap& heap, size_t size, uint8_t pattern) : Parent(),
+            heap_ (heap),
+            size_ (size),
+            toFill_ (true),
+            pattern_ (pattern){
+        }
+
+    private:
+    
+        /**
+         * @copydoc eoos::BenchmarkTask::iterate()
+         */
+        virtual int32_t iterate()
+        {
+            void* const addr( heap_.allocate(size_, NULLPTR) );
+            if(addr == NULLPTR)
+            {
+                return -1;
+            }
+            bool_t const isFilled( !toFill_ || fill(addr) );
+            heap_.free(addr);
+            return isFilled ? 1 : -1;
+        }
+
+        /**
+         * @brief Fills a memory block with the pattern and verifies it.
+         *
+         * @param addr Memory block address.
+         * @return True if the memory block content is not damaged.
+         */
+        bool_t fill(void* addr)
+        {
+            Memory::memset(addr, pattern_, size_);
+            uint8_t const* const block( reinterpret_cast<uint8_t const*>(addr) );
+            for(size_t i=0U; i<size_; i++)
+            {
+                if(block[i] != pattern_)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        api::Heap& heap_;           ///< Heap to allocate memory blocks.
+        size_t size_;               ///< Size of a memory block in Bytes.
+        bool_t toFill_;             ///< Fill and verify memory blocks flag.
+        uint8_t pattern_;           ///< Pattern to fill a memory block.
+    };
+    
+    /**
+     * @class ThreadChurn
+     * @brief Thread replacing memory blocks of random sizes in a churn heap.
+     */
+    class ThreadChurn : public BenchmarkTask
+    {
+        typedef BenchmarkTask Parent;
+    
+    public:
+
+        /**
+         * @brief Maximum size of a memory block in Bytes.
+         */
+        static const uint32_t MAX_BLOCK_SIZE = 512U;
+
+        /**
+         * @brief Number of memory blocks kept allocated.
+         *
+         * @note Blocks of 1 to the maximum size are a half of the maximum size in average,
+         *       so the blocks kept allocated occupy a half of the churn heap and block headers.
+         */
+        static const size_t NUMBER_OF_BLOCKS = CHURN_MEMORY_SIZE / MAX_BLOCK_SIZE;
+    
+        /**
+         * @brief Constructor.
+         *
+         * @param heap Heap to allocate memory blocks.
+         * @param pairs Number of allocate and free pairs to do.
+         */
+        ThreadChurn(api::Heap& heap, int32_t pairs) : Parent(),
+            pairs_ (pairs),
+            filled_ (0U),
+            random_ (0x19822014U),
+            heap_ (heap){
+            for(size_t i=0U; i<NUMBER_OF_BLOCKS; i++)
+            {
+                blocks_[i] = NULLPTR;
+            }
+        }
+
+        /**
+         * @brief Frees all memory blocks kept allocated.
+         */
+        void freeBlocks()
+        {
+            for(size_t i=0U; i<NUMBER_OF_BLOCKS; i++)
+            {
+                heap_.free(blocks_[i]);
+                blocks_[i] = NULLPTR;
+            }
+        }
+
+    private:
+    
+        /**
+         * @copydoc eoos::BenchmarkTask::iterate()
+         */
+        virtual int32_t iterate()
+        {
+            if(pairs_ == 0)
+            {
+                stopCounter();
+                return 0;
+            }
+            pairs_--;
+            // Fill all the blocks first to keep the heap occupied from the beginning
+            size_t index( filled_ );
+            if(filled_ < NUMBER_OF_BLOCKS)
+            {
+                filled_++;
+            }
+            else
+            {
+                uint32_t const random( (getRandom() << 16) | getRandom() );
+                index = static_cast<size_t>(random) % NUMBER_OF_BLOCKS;
+            }
+            size_t const size( static_cast<size_t>( getRandom() % MAX_BLOCK_SIZE + 1U ) );
+            heap_.free(blocks_[index]);
+            blocks_[index] = heap_.allocate(size, NULLPTR);
+            return (blocks_[index] != NULLPTR) ? 1 : -1;
+        }
+
+        /**
+         * @brief Returns a pseudo-random number.
+         *
+         * @return Linear congruential generator value.
+         */
+        uint32_t getRandom()
+        {
+            random_ = random_ * 1103515245U + 12345U;
+            return random_ >> 16;
+        }
+
+        int32_t pairs_;                     ///< Number of allocate and free pairs left.
+        size_t filled_;                     ///< Number of memory blocks filled at the beginning.
+        uint32_t random_;                   ///< Pseudo-random generator state.
+        api::Heap& heap_;                   ///< Heap to allocate memory blocks.
+        void* blocks_[NUMBER_OF_BLOCKS];    ///< Memory blocks kept allocated.
+    };
     
 private:
     
@@ -345,6 +588,107 @@ TEST_F(lib_HeapTest, allocate_deletionSequence)
 }
 
     
+/**
+ * @relates lib_HeapTest
+ * @brief Tests memory allocation alignment.
+ *
+ * @b Arrange:
+ *      - Initialize the EOOS system.
+ *      - Consctuct an object of the class.
+ *
+ * @b Act:
+ *      - Allocate memory blocks of all sizes from 1 to 32 Bytes.
+ *      - Free every second memory block to fragment the heap.
+ *      - Allocate memory blocks of all sizes from 1 to 32 Bytes again.
+ *
+ * @b Assert:
+ *      - Test all memory blocks are aligned to 64-bit word.
+ */
+TEST_F(lib_HeapTest, allocate_alignment)
+{
+    const uintptr_t ALIGNMENT( sizeof(uint64_t) );
+    const int32_t MAX_SIZE( 32 );
+    void* blocks[MAX_SIZE] = { NULLPTR };
+    Heap* heap( new (address_) Heap(MEMORY_SIZE, mutex_) );
+    ASSERT_NE(heap, NULLPTR) << "Fatal: Heap object is not allocated";
+    for(int32_t i=0; i<MAX_SIZE; i++)
+    {
+        blocks[i] = heap->allocate(i + 1, NULLPTR);
+        ASSERT_NE(blocks[i], NULLPTR) << "Fatal: Memory is not allocated";
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(blocks[i]) & (ALIGNMENT - 1U), 0U) << "Fatal: Memory is not aligned";
+    }
+    for(int32_t i=0; i<MAX_SIZE; i+=2)
+    {
+        heap->free(blocks[i]);
+        blocks[i] = NULLPTR;
+    }
+    for(int32_t i=0; i<MAX_SIZE; i+=2)
+    {
+        blocks[i] = heap->allocate(MAX_SIZE - i, NULLPTR);
+        ASSERT_NE(blocks[i], NULLPTR) << "Fatal: Memory is not allocated";
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(blocks[i]) & (ALIGNMENT - 1U), 0U) << "Fatal: Memory is not aligned on fragmented heap";
+    }
+    for(int32_t i=0; i<MAX_SIZE; i++)
+    {
+        heap->free(blocks[i]);
+    }
+    heap->~Heap();
+}
+
+/**
+ * @relates lib_HeapTest
+ * @brief Tests the largest free memory block after memory deletion.
+ *
+ * @b Arrange:
+ *      - Initialize the EOOS system.
+ *      - Consctuct an object of the class.
+ *      - Probe the largest memory block of the heap.
+ *
+ * @b Act:
+ *      - Allocate memory blocks.
+ *      - Free the memory blocks in sequence of merging with next, previous and both free blocks.
+ *
+ * @b Assert:
+ *      - Test the largest memory block decreases after the allocation.
+ *      - Test the largest memory block is restored after the deletion.
+ */
+TEST_F(lib_HeapTest, allocate_largestBlock)
+{
+    Heap* heap( new (address_) Heap(MEMORY_SIZE, mutex_) );
+    ASSERT_NE(heap, NULLPTR) << "Fatal: Heap object is not allocated";
+    size_t const largest( getLargestBlockSize(*heap) );
+    EXPECT_NE(largest, 0U) << "Fatal: Memory is not allocated";
+    EXPECT_LT(largest, MEMORY_SIZE) << "Fatal: Memory of heap object is allocated";
+    void* blocks[16] = { NULLPTR };
+    for(int32_t i=0; i<16; i++)
+    {
+        blocks[i] = heap->allocate(8, NULLPTR);
+        EXPECT_NE(blocks[i], NULLPTR) << "Fatal: Memory is not allocated";
+    }
+    EXPECT_LT(getLargestBlockSize(*heap), largest) << "Fatal: Largest block is not decreased";
+    // Delete if next free
+    heap->free(blocks[15]);
+    // Delete if prev or next free
+    heap->free(blocks[13]);
+    heap->free(blocks[14]);
+    // Delete first
+    heap->free(blocks[0]);
+    // Delete if prev free
+    heap->free(blocks[10]);
+    heap->free(blocks[11]);
+    EXPECT_LT(getLargestBlockSize(*heap), largest) << "Fatal: Largest block is restored before deletion";
+    // Delete just
+    for(int32_t i=12; i>0; i--)
+    {
+        if( (i != 10) && (i != 11) )
+        {
+            heap->free(blocks[i]);
+        }
+    }
+    EXPECT_EQ(getLargestBlockSize(*heap), largest) << "Fatal: Largest block is not restored";
+    heap->~Heap();
+}
+
 /**
  * @relates lib_HeapTest
  * @brief Tests memory allocation.
@@ -433,5 +777,271 @@ TEST_F(lib_HeapTest, allocate_overflow)
     EXPECT_EQ(nextToHeap, NEXT_TO_HEAP) << "Fatal: Integrity of heap memory is damaged by overflow";
 }
 
+/**
+ * @relates lib_HeapTest
+ * @brief Benchmarks memory allocation on occupied heap.
+ *
+ * @b Arrange:
+ *      - Initialize the EOOS system.
+ *      - Count the number of memory blocks the heap can allocate.
+ *
+ * @b Act:
+ *      - Occupy 10%, 50% and 90% of the heap by memory blocks.
+ *      - Allocate and free a memory block in a child thread during the benchmark time.
+ *
+ * @b Assert:
+ *      - Test all memory blocks are allocated.
+ *      - Output the number of allocate and free pairs per second.
+ */
+TEST_F(lib_HeapTest, benchmark_occupancy)
+{
+    const size_t BLOCK_SIZE( 8U );
+    const int32_t OCCUPANCY[3] = {10, 50, 90};
+    int32_t capacity( 0 );
+    {
+        Heap* heap( new (address_) Heap(MEMORY_SIZE, mutex_) );
+        ASSERT_NE(heap, NULLPTR) << "Fatal: Heap object is not allocated";
+        while( heap->allocate(BLOCK_SIZE, NULLPTR) != NULLPTR )
+        {
+            capacity++;
+        }
+        heap->~Heap();
+    }
+    ASSERT_NE(capacity, 0) << "Fatal: Memory is not allocated";
+    for(int32_t i=0; i<3; i++)
+    {
+        Heap* heap( new (address_) Heap(MEMORY_SIZE, mutex_) );
+        ASSERT_NE(heap, NULLPTR) << "Fatal: Heap object is not allocated";
+        int32_t const count( capacity * OCCUPANCY[i] / 100 );
+        for(int32_t j=0; j<count; j++)
+        {
+            EXPECT_NE(heap->allocate(BLOCK_SIZE, NULLPTR), NULLPTR) << "Fatal: Memory is not allocated";
+        }
+        ThreadAllocate thread(*heap, BLOCK_SIZE);
+        EXPECT_TRUE(thread.execute()) << "Error: Thread was not executed";
+        EXPECT_TRUE(Thread<>::sleep(TESTS_BENCHMARK_TIME)) << "Error: Thread sleep got a system error";
+        thread.stopCounter();
+        EXPECT_TRUE(thread.join()) << "Error: Thread was not joined";
+        EXPECT_FALSE(thread.isFailed()) << "Fatal: Memory is not allocated";
+        EXPECT_NE(thread.getCounter(), 0U) << "Fatal: Memory allocation is not counted";
+        reportRate("Heap allocate/free at occupancy percent", OCCUPANCY[i], thread.getCounter());
+        heap->~Heap();
+    }
+}
+
+/**
+ * @relates lib_HeapTest
+ * @brief Benchmarks memory allocation on fragmented heap.
+ *
+ * @b Arrange:
+ *      - Initialize the EOOS system.
+ *      - Allocate all memory blocks the heap can allocate.
+ *      - Free every second memory block to get holes unfit for a double size block.
+ *      - Free four last memory blocks to get a fit block at the end of the heap.
+ *
+ * @b Act:
+ *      - Allocate and free a double size memory block in a child thread during the benchmark time.
+ *
+ * @b Assert:
+ *      - Test all memory blocks are allocated.
+ *      - Output the number of allocate and free pairs per second.
+ */
+TEST_F(lib_HeapTest, benchmark_fragmentation)
+{
+    const size_t BLOCK_SIZE( 8U );
+    const int32_t MAX_BLOCKS( static_cast<int32_t>(MEMORY_SIZE / BLOCK_SIZE) );
+    void* blocks[MAX_BLOCKS] = { NULLPTR };
+    Heap* heap( new (address_) Heap(MEMORY_SIZE, mutex_) );
+    ASSERT_NE(heap, NULLPTR) << "Fatal: Heap object is not allocated";
+    int32_t count( 0 );
+    while(count < MAX_BLOCKS)
+    {
+        blocks[count] = heap->allocate(BLOCK_SIZE, NULLPTR);
+        if(blocks[count] == NULLPTR)
+        {
+            break;
+        }
+        count++;
+    }
+    ASSERT_GT(count, 8) << "Fatal: Memory is not allocated";
+    int32_t holes( 0 );
+    for(int32_t i=0; i<count-4; i+=2)
+    {
+        heap->free(blocks[i]);
+        holes++;
+    }
+    for(int32_t i=count-4; i<count; i++)
+    {
+        heap->free(blocks[i]);
+    }
+    ThreadAllocate thread(*heap, BLOCK_SIZE * 2U);
+    EXPECT_TRUE(thread.execute()) << "Error: Thread was not executed";
+    EXPECT_TRUE(Thread<>::sleep(TESTS_BENCHMARK_TIME)) << "Error: Thread sleep got a system error";
+    thread.stopCounter();
+    EXPECT_TRUE(thread.join()) << "Error: Thread was not joined";
+    EXPECT_FALSE(thread.isFailed()) << "Fatal: Memory is not allocated";
+    EXPECT_NE(thread.getCounter(), 0U) << "Fatal: Memory allocation is not counted";
+    reportRate("Heap allocate/free with unfit holes", holes, thread.getCounter());
+    heap->~Heap();
+}
+
+/**
+ * @relates lib_HeapTest
+ * @brief Benchmarks memory allocation by concurrent threads.
+ *
+ * @b Arrange:
+ *      - Initialize the EOOS system.
+ *
+ * @b Act:
+ *      - Create 1, 2, 4 and 8 threads sharing one heap.
+ *      - Allocate, fill and free a memory block in each thread during the benchmark time.
+ *
+ * @b Assert:
+ *      - Test all memory blocks are allocated and their content is not damaged.
+ *      - Output the number of allocate and free pairs per second for each number of threads.
+ */
+TEST_F(lib_HeapTest, benchmark_threads)
+{
+    const size_t BLOCK_SIZE( 64U );
+    const int32_t MAX_THREADS( 8 );
+    Heap* heap( new (address_) Heap(MEMORY_SIZE, mutex_) );
+    ASSERT_NE(heap, NULLPTR) << "Fatal: Heap object is not allocated";
+    for(int32_t number=1; number<=MAX_THREADS; number*=2)
+    {
+        ThreadAllocate* threads[MAX_THREADS] = { NULLPTR };
+        for(int32_t i=0; i<number; i++)
+        {
+            threads[i] = new ThreadAllocate(*heap, BLOCK_SIZE, static_cast<uint8_t>(i + 1));
+            ASSERT_NE(threads[i], NULLPTR) << "Fatal: Thread is not allocated";
+        }
+        for(int32_t i=0; i<number; i++)
+        {
+            EXPECT_TRUE(threads[i]->execute()) << "Error: Thread was not executed";
+        }
+        EXPECT_TRUE(Thread<>::sleep(TESTS_BENCHMARK_TIME)) << "Error: Thread sleep got a system error";
+        uint64_t counter( 0U );
+        for(int32_t i=0; i<number; i++)
+        {
+            threads[i]->stopCounter();
+        }
+        for(int32_t i=0; i<number; i++)
+        {
+            EXPECT_TRUE(threads[i]->join()) << "Error: Thread was not joined";
+            EXPECT_FALSE(threads[i]->isFailed()) << "Fatal: Memory is not allocated or damaged";
+            counter += threads[i]->getCounter();
+            delete threads[i];
+        }
+        EXPECT_NE(counter, 0U) << "Fatal: Memory allocation is not counted";
+        reportRate("Heap allocate/free by threads", number, counter);
+    }
+    heap->~Heap();
+}
+
+/**
+ * @relates lib_HeapTest
+ * @brief Benchmarks memory allocation by concurrent threads on own heaps.
+ *
+ * @b Arrange:
+ *      - Initialize the EOOS system.
+ *
+ * @b Act:
+ *      - Split the heap memory to 8 arenas and consctuct a heap with own mutex on each arena.
+ *      - Create 1, 2, 4 and 8 threads and pass each one a heap of an own arena.
+ *      - Allocate, fill and free a memory block in each thread during the benchmark time.
+ *
+ * @b Assert:
+ *      - Test all memory blocks are allocated and their content is not damaged.
+ *      - Output the number of allocate and free pairs per second for each number of threads.
+ */
+TEST_F(lib_HeapTest, benchmark_arenas)
+{
+    const size_t BLOCK_SIZE( 64U );
+    const int32_t MAX_THREADS( 8 );
+    const size_t ARENA_SIZE( MEMORY_SIZE / MAX_THREADS );
+    Mutex<> mutexes[MAX_THREADS];
+    for(int32_t number=1; number<=MAX_THREADS; number*=2)
+    {
+        Heap* heaps[MAX_THREADS] = { NULLPTR };
+        ThreadAllocate* threads[MAX_THREADS] = { NULLPTR };
+        for(int32_t i=0; i<number; i++)
+        {
+            heaps[i] = new (address_ + ARENA_SIZE * i) Heap(ARENA_SIZE, mutexes[i]);
+            ASSERT_NE(heaps[i], NULLPTR) << "Fatal: Heap object is not allocated";
+            threads[i] = new ThreadAllocate(*heaps[i], BLOCK_SIZE, static_cast<uint8_t>(i + 1));
+            ASSERT_NE(threads[i], NULLPTR) << "Fatal: Thread is not allocated";
+        }
+        for(int32_t i=0; i<number; i++)
+        {
+            EXPECT_TRUE(threads[i]->execute()) << "Error: Thread was not executed";
+        }
+        EXPECT_TRUE(Thread<>::sleep(TESTS_BENCHMARK_TIME)) << "Error: Thread sleep got a system error";
+        uint64_t counter( 0U );
+        for(int32_t i=0; i<number; i++)
+        {
+            threads[i]->stopCounter();
+        }
+        for(int32_t i=0; i<number; i++)
+        {
+            EXPECT_TRUE(threads[i]->join()) << "Error: Thread was not joined";
+            EXPECT_FALSE(threads[i]->isFailed()) << "Fatal: Memory is not allocated or damaged";
+            counter += threads[i]->getCounter();
+            delete threads[i];
+            heaps[i]->~Heap();
+        }
+        EXPECT_NE(counter, 0U) << "Fatal: Memory allocation is not counted";
+        reportRate("Heap allocate/free by threads on own arenas", number, counter);
+    }
+}
+
+/**
+ * @relates lib_HeapTest
+ * @brief Benchmarks memory allocation of random sizes on a long running heap.
+ *
+ * @b Arrange:
+ *      - Initialize the EOOS system.
+ *      - Consctuct an object of the class on churn memory of 4 MiB by default.
+ *      - Probe the largest memory block of the heap.
+ *
+ * @b Act:
+ *      - Occupy a half of the heap by memory blocks of random sizes in a child thread.
+ *      - Replace random memory blocks with blocks of random sizes in the child thread for 1000000 pairs by default.
+ *      - Count the benchmark times passed until the child thread completes.
+ *      - Probe the largest memory block of the heap.
+ *      - Free all memory blocks.
+ *
+ * @b Assert:
+ *      - Test all memory blocks are allocated.
+ *      - Test the largest memory block is restored after the deletion.
+ *      - Output the number of allocate and free pairs per second, and the largest memory block after the churn.
+ */
+TEST_F(lib_HeapTest, benchmark_churn)
+{
+    Heap* heap( new (churnAddress_) Heap(CHURN_MEMORY_SIZE, mutex_) );
+    ASSERT_NE(heap, NULLPTR) << "Fatal: Heap object is not allocated";
+    size_t const largest( getLargestBlockSize(*heap, CHURN_MEMORY_SIZE) );
+    EXPECT_NE(largest, 0U) << "Fatal: Memory is not allocated";
+    ThreadChurn* const thread( new ThreadChurn(*heap, CHURN_PAIRS) );
+    ASSERT_NE(thread, NULLPTR) << "Fatal: Thread is not allocated";
+    EXPECT_TRUE(thread->execute()) << "Error: Thread was not executed";
+    // The time is measured with the benchmark time accuracy as lib has no clock
+    uint64_t times( 0U );
+    do
+    {
+        EXPECT_TRUE(Thread<>::sleep(TESTS_BENCHMARK_TIME)) << "Error: Thread sleep got a system error";
+        times++;
+    }
+    while( (thread->getCounter() < static_cast<uint64_t>(CHURN_PAIRS)) && !thread->isFailed() );
+    EXPECT_TRUE(thread->join()) << "Error: Thread was not joined";
+    EXPECT_FALSE(thread->isFailed()) << "Fatal: Memory is not allocated";
+    EXPECT_EQ(thread->getCounter(), static_cast<uint64_t>(CHURN_PAIRS)) << "Fatal: Memory allocation is not counted";
+    size_t const churned( getLargestBlockSize(*heap, CHURN_MEMORY_SIZE) );
+    thread->freeBlocks();
+    EXPECT_EQ(getLargestBlockSize(*heap, CHURN_MEMORY_SIZE), largest) << "Fatal: Largest block is not restored";
+    reportRate("Heap allocate/free of random sizes", thread->getCounter() / times);
+    reportShare("Heap largest block after random sizes", churned, largest);
+    delete thread;
+    heap->~Heap();
+}
+
 } // namespace lib
 } // namespace eoos
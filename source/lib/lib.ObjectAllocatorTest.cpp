@@ -6,6 +6,8 @@
  * @brief Unit tests of `lib::ObjectAllocator`.
  */
 #include "lib.ObjectAllocator.hpp"
+#include "lib.Allocator.hpp"
+#include "lib.Thread.hpp"
 #include "System.hpp"
 
 namespace eoos
@@ -55,6 +57,100 @@ protected:
 
     };
 
+    /**
+     * @class HeapAllocator
+     * @brief Default memory allocator with no-op reset.
+     */
+    class HeapAllocator
+    {
+    
+    public:
+
+        /**
+         * @copydoc eoos::lib::Allocator::allocate(size_t)
+         */
+        static void* allocate(size_t size)
+        {
+            return Allocator::allocate(size);
+        }
+
+        /**
+         * @copydoc eoos::lib::Allocator::free(void*)
+         */
+        static void free(void* ptr)
+        {
+            Allocator::free(ptr);
+        }
+
+        /**
+         * @brief Does nothing as memory is freed one by one.
+         */
+        static void reset()
+        {
+        }
+
+    };
+
+    /**
+     * @class ThreadAllocate<A>
+     * @brief Thread allocating and freeing groups of objects.
+     *
+     * @tparam A Heap memory allocator class.
+     */
+    template <class A>
+    class ThreadAllocate : public BenchmarkTask
+    {
+        typedef BenchmarkTask Parent;
+
+    public:
+
+        /**
+         * @brief Number of objects allocated in a group.
+         */
+        static const int32_t NUMBER_OF_OBJECTS = 16;
+
+        /**
+         * @brief Size of an object in Bytes.
+         */
+        static const size_t OBJECT_SIZE = 24U;
+
+        /**
+         * @brief Constructor.
+         */
+        ThreadAllocate() : Parent(){
+        }
+
+    private:
+
+        /**
+         * @copydoc eoos::BenchmarkTask::iterate()
+         */
+        virtual int32_t iterate()
+        {
+            void* objects[NUMBER_OF_OBJECTS] = { NULLPTR };
+            bool_t isAllocated( true );
+            for(int32_t i=0; i<NUMBER_OF_OBJECTS; i++)
+            {
+                objects[i] = ObjectAllocator<A>::operator new(OBJECT_SIZE);
+                if(objects[i] == NULLPTR)
+                {
+                    isAllocated = false;
+                }
+            }
+            for(int32_t i=0; i<NUMBER_OF_OBJECTS; i++)
+            {
+                ObjectAllocator<A>::operator delete(objects[i]);
+            }
+            A::reset();
+            int32_t number( -1 );
+            if(isAllocated)
+            {
+                number = NUMBER_OF_OBJECTS;
+            }
+            return number;
+        }
+    };
+
 private:
     
     System eoos_; ///< EOOS Operating System.
@@ -89,5 +185,102 @@ TEST_F(lib_ObjectAllocatorTest, allocation)
     }
 }
 
+/**
+ * @relates lib_ObjectAllocatorTest
+ * @brief Tests the class with a monotonic allocator.
+ *
+ * @b Arrange:
+ *      - Initialize the EOOS system.
+ *      - Reset the monotonic allocator.
+ *
+ * @b Act:
+ *      - Allocate memory of different sizes.
+ *      - Free and reset the memory.
+ *
+ * @b Assert:
+ *      - Test the memory is allocated one by one with alignment.
+ *      - Test the freed memory is not reused.
+ *      - Test the reset memory is reused.
+ *      - Test the memory over the allocator memory is not allocated.
+ *      - Test the memory of sizes wrapping on alignment is not allocated.
+ */
+TEST_F(lib_ObjectAllocatorTest, allocation_monotonic)
+{
+    typedef ObjectAllocator<MonotonicAllocator> Monotonic;
+    uint8_t* const addr( reinterpret_cast<uint8_t*>( MonotonicAllocator::getMemory() ) );
+    MonotonicAllocator::reset();
+    {
+        void* mem0 = Monotonic::operator new(8);
+        EXPECT_EQ(mem0, addr) << "Fatal: Memory is not allocated";
+        void* mem1 = Monotonic::operator new(1);
+        EXPECT_EQ(mem1, addr + 8) << "Fatal: Memory is not allocated one by one";
+        void* mem2 = Monotonic::operator new(9);
+        EXPECT_EQ(mem2, addr + 16) << "Fatal: Memory is not aligned";
+        Monotonic::operator delete(mem2);
+        void* mem3 = Monotonic::operator new(8);
+        EXPECT_EQ(mem3, addr + 32) << "Fatal: Freed memory is reused";
+        Monotonic::operator delete(mem3);
+        Monotonic::operator delete(mem1);
+        Monotonic::operator delete(mem0);
+    }
+    MonotonicAllocator::reset();
+    {
+        void* mem = Monotonic::operator new(TESTS_MONOTONIC_ALLOCATOR_SIZE);
+        EXPECT_EQ(mem, addr) << "Fatal: Reset memory is not reused";
+        void* over = Monotonic::operator new(1);
+        EXPECT_EQ(over, NULLPTR) << "Fatal: Memory over allocator is allocated";
+        Monotonic::operator delete(mem);
+    }
+    MonotonicAllocator::reset();
+    {
+        void* huge = Monotonic::operator new(~static_cast<size_t>(0U));
+        EXPECT_EQ(huge, NULLPTR) << "Fatal: Memory of maximum size is allocated";
+        huge = Monotonic::operator new(~static_cast<size_t>(0U) - MonotonicAllocator::ALIGNMENT + 2U);
+        EXPECT_EQ(huge, NULLPTR) << "Fatal: Memory of wrapped aligned size is allocated";
+        void* mem = Monotonic::operator new(8);
+        EXPECT_EQ(mem, addr) << "Fatal: Memory is moved by failed allocation";
+        Monotonic::operator delete(mem);
+    }
+    MonotonicAllocator::reset();
+}
+
+/**
+ * @relates lib_ObjectAllocatorTest
+ * @brief Benchmarks the class with monotonic and default allocators.
+ *
+ * @b Arrange:
+ *      - Initialize the EOOS system.
+ *
+ * @b Act:
+ *      - Allocate groups of objects, free them and reset an allocator in a child thread during the benchmark time.
+ *
+ * @b Assert:
+ *      - Test all objects are allocated.
+ *      - Output the number of allocated and freed objects per second for both allocators.
+ */
+TEST_F(lib_ObjectAllocatorTest, benchmark_monotonic)
+{
+    {
+        ThreadAllocate<MonotonicAllocator> thread;
+        EXPECT_TRUE(thread.execute()) << "Error: Thread was not executed";
+        EXPECT_TRUE(Thread<>::sleep(TESTS_BENCHMARK_TIME)) << "Error: Thread sleep got a system error";
+        thread.stopCounter();
+        EXPECT_TRUE(thread.join()) << "Error: Thread was not joined";
+        EXPECT_FALSE(thread.isFailed()) << "Fatal: Memory is not allocated";
+        EXPECT_NE(thread.getCounter(), 0U) << "Fatal: Memory allocation is not counted";
+        reportRate("Monotonic allocator objects", thread.getCounter());
+    }
+    {
+        ThreadAllocate<HeapAllocator> thread;
+        EXPECT_TRUE(thread.execute()) << "Error: Thread was not executed";
+        EXPECT_TRUE(Thread<>::sleep(TESTS_BENCHMARK_TIME)) << "Error: Thread sleep got a system error";
+        thread.stopCounter();
+        EXPECT_TRUE(thread.join()) << "Error: Thread was not joined";
+        EXPECT_FALSE(thread.isFailed()) << "Fatal: Memory is not allocated";
+        EXPECT_NE(thread.getCounter(), 0U) << "Fatal: Memory allocation is not counted";
+        reportRate("Default allocator objects", thread.getCounter());
+    }
+}
+
 } // namespace lib
 } // namespace eoos
@@ -7,6 +7,7 @@
  */
 #include "lib.Semaphore.hpp"
 #include "lib.AbstractThreadTask.hpp"
+#include "lib.Thread.hpp"
 #include "System.hpp"
 
 namespace eoos
@@ -42,6 +43,21 @@ protected:
          */
         ThreadTask(api::Semaphore& semAcquire, api::Semaphore& semRelease) : Parent(),
             isAcquired_ (false),
+            permits_ (1),
+            semAcquire_ (semAcquire),
+            semRelease_ (semRelease){
+        }
+
+        /**
+         * @brief Constructor.
+         *
+         * @param semAcquire Semaphore to acquire in the thread.
+         * @param semRelease Semaphore to release in the thread after the acquirement.
+         * @param permits Number of permits to acquire in the thread.
+         */
+        ThreadTask(api::Semaphore& semAcquire, api::Semaphore& semRelease, int32_t permits) : Parent(),
+            isAcquired_ (false),
+            permits_ (permits),
             semAcquire_ (semAcquire),
             semRelease_ (semRelease){
         }
@@ -63,15 +79,152 @@ protected:
          */        
         virtual void start()
         {
-            isAcquired_ = semAcquire_.acquire();
+            bool_t isAcquired( true );
+            for(int32_t i=0; i<permits_; i++)
+            {
+                isAcquired &= semAcquire_.acquire();
+            }
+            isAcquired_ = isAcquired;
             semRelease_.release();
         }
         
         bool_t isAcquired_;          ///< Acquirement flag.
+        int32_t permits_;            ///< Number of permits to acquire.
         api::Semaphore& semAcquire_; ///< Semaphore to acquire in the thread.
         api::Semaphore& semRelease_; ///< Semaphore to release in the thread after the acquirement.
     };
     
+    /**
+     * @class ThreadPingPong
+     * @brief Semaphore ping-pong task for the test.
+     */
+    class ThreadPingPong : public BenchmarkTask
+    {
+        typedef BenchmarkTask Parent;
+    
+    public:
+
+        /**
+         * @enum Role
+         * @brief Role in the ping-pong.
+         */
+        enum Role
+        {
+            ROLE_INITIATOR,
+            ROLE_REACTOR
+        };
+        
+        /**
+         * @brief Constructor.
+         *
+         * @param role Role in the ping-pong.
+         * @param semAcquire Semaphore to acquire in the thread.
+         * @param semRelease Semaphore to release in the thread.
+         */
+        ThreadPingPong(Role role, api::Semaphore& semAcquire, api::Semaphore& semRelease) : Parent(),
+            role_ (role),
+            semAcquire_ (semAcquire),
+            semRelease_ (semRelease){
+        }
+                        
+    private:    
+            
+        /**
+         * @copydoc eoos::BenchmarkTask::iterate()
+         */        
+        virtual int32_t iterate()
+        {
+            return (role_ == ROLE_INITIATOR) ? initiate() : react();
+        }
+
+        /**
+         * @brief Sends a ping and waits a pong.
+         *
+         * @return One round trip, or -1 if a semaphore operation failed.
+         */
+        int32_t initiate()
+        {
+            if( !semRelease_.release() || !semAcquire_.acquire() )
+            {
+                return -1;
+            }
+            return 1;
+        }
+
+        /**
+         * @brief Waits a ping and sends a pong.
+         *
+         * @return One round trip, zero if the counter is stopped, or -1 if a semaphore operation failed.
+         */
+        int32_t react()
+        {
+            if( !semAcquire_.acquire() )
+            {
+                return -1;
+            }
+            if( !isCounting() )
+            {
+                return 0;
+            }
+            if( !semRelease_.release() )
+            {
+                return -1;
+            }
+            return 1;
+        }
+        
+        Role role_;                  ///< Role in the ping-pong.
+        api::Semaphore& semAcquire_; ///< Semaphore to acquire in the thread.
+        api::Semaphore& semRelease_; ///< Semaphore to release in the thread.
+    };
+
+    /**
+     * @class ThreadTransfer
+     * @brief Semaphore permits transfer task for the test.
+     */
+    class ThreadTransfer : public BenchmarkTask
+    {
+        typedef BenchmarkTask Parent;
+    
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param semAcquire Semaphore to acquire permits in the thread.
+         * @param semRelease Semaphore to release permits in the thread.
+         */
+        ThreadTransfer(api::Semaphore& semAcquire, api::Semaphore& semRelease) : Parent(),
+            semAcquire_ (semAcquire),
+            semRelease_ (semRelease){
+        }
+                        
+    private:    
+            
+        /**
+         * @copydoc eoos::BenchmarkTask::iterate()
+         */        
+        virtual int32_t iterate()
+        {
+            if( !semAcquire_.acquire() )
+            {
+                return -1;
+            }
+            if( !isCounting() )
+            {
+                return 0;
+            }
+            if( !semRelease_.release() )
+            {
+                return -1;
+            }
+            return 1;
+        }
+        
+        api::Semaphore& semAcquire_; ///< Semaphore to acquire permits in the thread.
+        api::Semaphore& semRelease_; ///< Semaphore to release permits in the thread.
+    };
+    
 private:
 
     System eoos_; ///< EOOS Operating System.
@@ -162,5 +315,118 @@ TEST_F(lib_SemaphoreTest, acquire)
     EXPECT_TRUE(thread.join()) << "Error: Thread was not joined";
 }
 
+/**
+ * @relates lib_SemaphoreTest
+ * @brief Semaphore multiple permits acquire test. 
+ *
+ * @b Arrange:
+ *      - Initialize the EOOS system.
+ *
+ * @b Act:
+ *      - Create a semaphore with a half of permits.
+ *      - Create a child thread acquiring all the permits of the semaphore.
+ *      - Release other half of the permits in the primary thread.
+ *      - Release other semaphore in the child thread and acquire it in the primary thread.
+ *
+ * @b Assert:
+ *      - Check all the permits are acquired in the child thread.
+ */
+TEST_F(lib_SemaphoreTest, acquire_multiplePermits)
+{
+    const int32_t PERMITS( 8 );
+    Semaphore<> semAcquire(PERMITS / 2);
+    Semaphore<> semRelease(0);
+    ThreadTask thread(semAcquire, semRelease, PERMITS);
+    EXPECT_TRUE(thread.isConstructed()) << "Error: Thread for Semaphore testing is not constructed";
+    EXPECT_TRUE(thread.execute()) << "Error: Thread was not executed";
+    for(int32_t i=PERMITS / 2; i<PERMITS; i++)
+    {
+        EXPECT_TRUE(semAcquire.release()) << "Fatal: Semaphore was not released in the primary thread";
+    }
+    EXPECT_TRUE(semRelease.acquire()) << "Fatal: Semaphore was not acquired in the primary thread";
+    EXPECT_TRUE(thread.wasAcquired()) << "Fatal: Semaphore permits were not acquired in the child thread";
+    EXPECT_TRUE(thread.join()) << "Error: Thread was not joined";
+}
+
+/**
+ * @relates lib_SemaphoreTest
+ * @brief Benchmarks semaphore ping-pong between two threads. 
+ *
+ * @b Arrange:
+ *      - Initialize the EOOS system.
+ *
+ * @b Act:
+ *      - Create an initiator thread releasing a ping semaphore and acquiring a pong semaphore.
+ *      - Create a reactor thread acquiring the ping semaphore and releasing the pong semaphore.
+ *      - Run the ping-pong during the benchmark time.
+ *
+ * @b Assert:
+ *      - Check no semaphore operation failed and both threads did the same number of round trips.
+ *      - Output the number of round trips per second.
+ */
+TEST_F(lib_SemaphoreTest, benchmark_pingPong)
+{
+    Semaphore<> semPing(0);
+    Semaphore<> semPong(0);
+    ThreadPingPong initiator(ThreadPingPong::ROLE_INITIATOR, semPong, semPing);
+    ThreadPingPong reactor(ThreadPingPong::ROLE_REACTOR, semPing, semPong);
+    EXPECT_TRUE(reactor.execute()) << "Error: Reactor thread was not executed";
+    EXPECT_TRUE(initiator.execute()) << "Error: Initiator thread was not executed";
+    EXPECT_TRUE(Thread<>::sleep(TESTS_BENCHMARK_TIME)) << "Error: Thread sleep got a system error";
+    initiator.stopCounter();
+    EXPECT_TRUE(initiator.join()) << "Error: Initiator thread was not joined";
+    reactor.stopCounter();
+    EXPECT_TRUE(semPing.release()) << "Fatal: Semaphore was not released in the primary thread";
+    EXPECT_TRUE(reactor.join()) << "Error: Reactor thread was not joined";
+    EXPECT_FALSE(initiator.isFailed()) << "Fatal: Semaphore operation failed in the initiator thread";
+    EXPECT_FALSE(reactor.isFailed()) << "Fatal: Semaphore operation failed in the reactor thread";
+    EXPECT_NE(initiator.getCounter(), 0U) << "Fatal: Round trips are not counted";
+    EXPECT_EQ(initiator.getCounter(), reactor.getCounter()) << "Fatal: Round trips are lost";
+    reportRate("Semaphore ping-pong round trips", initiator.getCounter());
+}
+
+/**
+ * @relates lib_SemaphoreTest
+ * @brief Benchmarks semaphore permits passed from a producer to a consumer thread. 
+ *
+ * @b Arrange:
+ *      - Initialize the EOOS system.
+ *
+ * @b Act:
+ *      - Create a space semaphore with 1, 8 and 64 permits and an item semaphore without permits.
+ *      - Create a producer thread acquiring the space semaphore and releasing the item semaphore.
+ *      - Create a consumer thread acquiring the item semaphore and releasing the space semaphore.
+ *      - Pass the permits during the benchmark time.
+ *
+ * @b Assert:
+ *      - Check no semaphore operation failed and no more permits are outstanding than the space has.
+ *      - Output the number of permits passed per second for each number of outstanding permits.
+ */
+TEST_F(lib_SemaphoreTest, benchmark_producerConsumer)
+{
+    const int32_t MAX_OUTSTANDING( 64 );
+    for(int32_t outstanding=1; outstanding<=MAX_OUTSTANDING; outstanding*=8)
+    {
+        Semaphore<> semSpace(outstanding);
+        Semaphore<> semItem(0);
+        ThreadTransfer producer(semSpace, semItem);
+        ThreadTransfer consumer(semItem, semSpace);
+        EXPECT_TRUE(consumer.execute()) << "Error: Consumer thread was not executed";
+        EXPECT_TRUE(producer.execute()) << "Error: Producer thread was not executed";
+        EXPECT_TRUE(Thread<>::sleep(TESTS_BENCHMARK_TIME)) << "Error: Thread sleep got a system error";
+        producer.stopCounter();
+        EXPECT_TRUE(producer.join()) << "Error: Producer thread was not joined";
+        consumer.stopCounter();
+        EXPECT_TRUE(semItem.release()) << "Fatal: Semaphore was not released in the primary thread";
+        EXPECT_TRUE(consumer.join()) << "Error: Consumer thread was not joined";
+        EXPECT_FALSE(producer.isFailed()) << "Fatal: Semaphore operation failed in the producer thread";
+        EXPECT_FALSE(consumer.isFailed()) << "Fatal: Semaphore operation failed in the consumer thread";
+        EXPECT_NE(consumer.getCounter(), 0U) << "Fatal: Permits are not counted";
+        EXPECT_LE(consumer.getCounter(), producer.getCounter()) << "Fatal: Permits are consumed before produced";
+        EXPECT_LE(producer.getCounter() - consumer.getCounter(), static_cast<uint64_t>(outstanding)) << "Fatal: Permits are outstanding over the space";
+        reportRate("Semaphore permits passed with outstanding permits", outstanding, consumer.getCounter());
+    }
+}
+
 } // namespace lib
 } // namespace eoos
@@ -181,6 +181,16 @@ protected:
             return error_;
         }
         
+        /**
+         * @brief Tests if the task has the system default stack size.
+         *
+         * @return True if the stack size is not defined by this task.
+         */
+        bool_t hasDefaultStack() const
+        {
+            return stackSize_ == 0;
+        }
+        
         /**
          * @copydoc eoos::api::Task::getStackSize()
          */
@@ -348,6 +358,44 @@ protected:
         size_t stackSize_;          ///< Task stack size.
     };
 
+    /**
+     * @class Spawner
+     * @brief Task creating, executing and joining threads of a task.
+     */
+    class Spawner : public BenchmarkTask
+    {
+        typedef BenchmarkTask Parent;
+
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param task Task to execute in the threads.
+         */
+        Spawner(api::Task& task) 
+            : Parent()
+            , task_ (task) {
+        }
+
+    private:
+
+        /**
+         * @copydoc eoos::BenchmarkTask::iterate()
+         */        
+        virtual int32_t iterate()
+        {
+            Thread<> thread(task_);
+            if( !thread.execute() || !thread.join() )
+            {
+                return -1;
+            }
+            return 1;
+        }
+
+        api::Task& task_;           ///< Task to execute in the threads.
+    };
+
     /**
      * @struct Tasks
      * @brief Task collection under test.
@@ -704,5 +752,44 @@ TEST_F(lib_ThreadTest, sleep_wrongArgs)
     EXPECT_FALSE(Thread<>::sleep(-1)) << "Fatal: Thread sleep with negate time argument";
 }
 
+/**
+ * @relates lib_ThreadTest
+ * @brief Benchmarks thread creation, execution and joining.
+ *
+ * @b Arrange:
+ *      - Initialize the EOOS system.
+ *
+ * @b Act:
+ *      - Run a spawner thread which creates, executes and joins a thread of a task during the benchmark time.
+ *      - Repeat for a task with default stack and a task with 16 KiB stack.
+ *
+ * @b Assert:
+ *      - Test all threads are executed and joined.
+ *      - Output the number of threads per second for each task.
+ */
+TEST_F(lib_ThreadTest, benchmark_executeJoin)
+{
+    Task* const tasks[2] = {&task.normal, &task.stack};
+    for(int32_t i=0; i<2; i++)
+    {
+        Spawner spawner(*tasks[i]);
+        EXPECT_TRUE(spawner.execute()) << "Error: Thread was not executed";
+        EXPECT_TRUE(Thread<>::sleep(TESTS_BENCHMARK_TIME)) << "Error: Thread sleep got a system error";
+        spawner.stopCounter();
+        EXPECT_TRUE(spawner.join()) << "Error: Thread was not joined";
+        EXPECT_FALSE(spawner.isFailed()) << "Fatal: Thread was not executed or joined";
+        EXPECT_NE(spawner.getCounter(), 0U) << "Fatal: Threads are not counted";
+        if( tasks[i]->hasDefaultStack() )
+        {
+            reportRate("Thread create/execute/join with default stack", spawner.getCounter());
+        }
+        else
+        {
+            int32_t const stack( static_cast<int32_t>( tasks[i]->getStackSize() ) );
+            reportRate("Thread create/execute/join with stack bytes", stack, spawner.getCounter());
+        }
+    }
+}
+
 } // namespace lib
 } // namespace eoos